@@ -0,0 +1,157 @@
+// Host benchmark for the rgb_status_led sigma-delta dithering stage.
+//
+// For constant levels it reports the error of plain rounding and of dithering,
+// plus the worst-case spacing of the dither pattern's minority pulses (the
+// period the eye sees as flicker) in updates, and as a rate at the default
+// ~16ms loop and at a 1ms high-frequency loop. It then shows the error with the
+// DITHER_MIN_FLICKER_HZ bound applied, for a slow pulse-style ramp, and the
+// cost per call. Build and run from the repository root:
+//
+//   g++ -O2 -std=c++17 -o /tmp/dither_bench benchmarks/dither_bench.cpp && /tmp/dither_bench
+
+#include "../components/rgb_status_led/sigma_delta.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using esphome::rgb_status_led::DITHER_MIN_FLICKER_HZ;
+using esphome::rgb_status_led::sigma_delta_max_spacing;
+using esphome::rgb_status_led::sigma_delta_quantize;
+
+namespace {
+
+const int32_t UNBOUNDED = 1 << 30;
+const uint32_t SLOW_LOOP_US = 16000;  // ESPHome default loop interval
+const uint32_t FAST_LOOP_US = 1000;   // High-frequency loop, as requested while dithering
+
+float round_to_code(float level, int32_t max_code) {
+  return std::round(level * max_code) / static_cast<float>(max_code);
+}
+
+struct PatternStats {
+  double mean_error;
+  int worst_spacing;  // Longest gap between minority-code pulses, in updates (0 = no pattern)
+};
+
+PatternStats run_constant(float level, int32_t max_code, int32_t max_spacing) {
+  const int warmup = 512, updates = 8192;
+  int32_t residual = 0;
+  std::vector<int32_t> codes;
+  double sum = 0.0;
+  for (int i = 0; i < warmup + updates; i++) {
+    float out = sigma_delta_quantize(level, max_code, residual, max_spacing);
+    if (i >= warmup) {
+      sum += out;
+      codes.push_back(static_cast<int32_t>(std::lround(out * max_code)));
+    }
+  }
+
+  // The minority code is whichever of the two emitted codes is rarer
+  int32_t low = codes[0], high = codes[0];
+  for (int32_t c : codes) {
+    low = std::min(low, c);
+    high = std::max(high, c);
+  }
+  int worst = 0;
+  if (low != high) {
+    int high_count = 0;
+    for (int32_t c : codes)
+      high_count += (c == high);
+    int32_t minority = (high_count * 2 <= updates) ? high : low;
+    int last = -1;
+    for (int i = 0; i < updates; i++) {
+      if (codes[i] == minority) {
+        if (last >= 0)
+          worst = std::max(worst, i - last);
+        last = i;
+      }
+    }
+  }
+  return {sum / updates - level, worst};
+}
+
+double flicker_hz(int spacing, uint32_t interval_us) { return 1e6 / (static_cast<double>(spacing) * interval_us); }
+
+void bench_constant(int bits) {
+  const int32_t max_code = (1 << bits) - 1;
+  const int32_t fast_spacing = sigma_delta_max_spacing(FAST_LOOP_US);
+  const float levels[] = {0.0005f, 0.001f, 0.0025f, 0.005f, 0.0137f, 0.05f, 0.25f, 0.5f};
+
+  std::printf("\nConstant levels, %d-bit output (flicker limit %uHz, bound at 1ms loop = %d updates)\n", bits,
+              DITHER_MIN_FLICKER_HZ, fast_spacing);
+  std::printf("  %8s %8s %11s %11s %8s %10s %10s %11s\n", "level", "codes", "rounded", "dithered", "spacing",
+              "Hz @16ms", "Hz @1ms", "bounded@1ms");
+  for (float level : levels) {
+    PatternStats free_run = run_constant(level, max_code, UNBOUNDED);
+    PatternStats bounded = run_constant(level, max_code, fast_spacing);
+    double rounded_err = round_to_code(level, max_code) - level;
+    if (free_run.worst_spacing > 0) {
+      std::printf("  %8.5f %8.3f %+11.7f %+11.7f %8d %10.1f %10.1f %+11.7f\n", level, level * max_code, rounded_err,
+                  free_run.mean_error, free_run.worst_spacing, flicker_hz(free_run.worst_spacing, SLOW_LOOP_US),
+                  flicker_hz(free_run.worst_spacing, FAST_LOOP_US), bounded.mean_error);
+    } else {
+      std::printf("  %8.5f %8.3f %+11.7f %+11.7f %8s %10s %10s %+11.7f\n", level, level * max_code, rounded_err,
+                  free_run.mean_error, "-", "-", "-", bounded.mean_error);
+    }
+  }
+}
+
+void bench_ramp(int bits) {
+  // Pulse fade from 0 to 5% (the dim end of a 0.5 brightness pulse) at a 1ms
+  // loop with the flicker bound applied; error is judged per flicker period
+  const int32_t max_code = (1 << bits) - 1;
+  const int32_t spacing = sigma_delta_max_spacing(FAST_LOOP_US);
+  const int updates = 8192;
+  const float top = 0.05f;
+
+  int32_t residual = 0;
+  double rounded_abs = 0.0, dithered_abs = 0.0;
+  double rounded_win = 0.0, dithered_win = 0.0, target_win = 0.0;
+  int windows = 0;
+  for (int i = 0; i < updates; i++) {
+    float level = top * i / (updates - 1);
+    target_win += level;
+    rounded_win += round_to_code(level, max_code);
+    dithered_win += sigma_delta_quantize(level, max_code, residual, spacing);
+    if ((i + 1) % spacing == 0) {
+      rounded_abs += std::fabs(rounded_win - target_win) / spacing;
+      dithered_abs += std::fabs(dithered_win - target_win) / spacing;
+      rounded_win = dithered_win = target_win = 0.0;
+      windows++;
+    }
+  }
+  std::printf("\nRamp 0..%.2f, %d-bit output, 1ms loop, bounded, mean |error| per %d-update (%uHz) window\n", top,
+              bits, spacing, DITHER_MIN_FLICKER_HZ);
+  std::printf("  rounded:  %.7f (%.3f codes)\n", rounded_abs / windows, rounded_abs / windows * max_code);
+  std::printf("  dithered: %.7f (%.3f codes)\n", dithered_abs / windows, dithered_abs / windows * max_code);
+}
+
+void bench_cost() {
+  const int32_t max_code = 255;
+  const int32_t spacing = sigma_delta_max_spacing(FAST_LOOP_US);
+  const int calls = 10000000;
+  int32_t residual[3] = {0, 0, 0};
+  volatile float sink = 0.0f;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++) {
+    float level = static_cast<float>(i & 0xFFF) / 4096.0f;
+    sink = sink + sigma_delta_quantize(level, max_code, residual[i % 3], spacing);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  std::printf("\nCost: %.2f ns/call on this host (%d calls)\n", ns / calls, calls);
+}
+
+}  // namespace
+
+int main() {
+  for (int bits : {8, 10}) {
+    bench_constant(bits);
+    bench_ramp(bits);
+  }
+  bench_cost();
+  return 0;
+}
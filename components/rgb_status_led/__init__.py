@@ -14,12 +14,13 @@ License: MIT
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import light, output
+from esphome.components.rgb_status_led_common import BatchedRGBOutput
 from esphome.const import CONF_ID, CONF_OUTPUT, CONF_RED, CONF_GREEN, CONF_BLUE
 from esphome.core import CoroPriority, coroutine_with_priority
 
 # Component metadata
 CODEOWNERS = ["@esphome/core"]
-AUTO_LOAD = ["light"]
+AUTO_LOAD = ["light", "rgb_status_led_common"]
 
 # Namespace for the component
 rgb_status_led_ns = cg.esphome_ns.namespace("rgb_status_led")
@@ -51,6 +52,8 @@ CONF_WARNING_BLINK_SPEED = "warning_blink_speed"
 CONF_BRIGHTNESS = "brightness"
 CONF_PRIORITY_MODE = "priority_mode"
 CONF_OK_STATE_ENABLED = "ok_state_enabled"
+CONF_BATCHED_OUTPUT = "batched_output"
+CONF_DITHER_BITS = "dither_bits"
 
 # Schema for RGB color configuration
 ColorSchema = cv.Schema({
@@ -73,10 +76,13 @@ CONFIG_SCHEMA = light.RGB_LIGHT_SCHEMA.extend(
         # Component ID for code generation
         cv.GenerateID(): cv.declare_id(RGBStatusLED),
         
-        # Required RGB output connections
-        cv.Required(CONF_RED): cv.use_id(output.FloatOutput),
-        cv.Required(CONF_GREEN): cv.use_id(output.FloatOutput),
-        cv.Required(CONF_BLUE): cv.use_id(output.FloatOutput),
+        # RGB output connections (not needed when a batched output is used)
+        cv.Optional(CONF_RED): cv.use_id(output.FloatOutput),
+        cv.Optional(CONF_GREEN): cv.use_id(output.FloatOutput),
+        cv.Optional(CONF_BLUE): cv.use_id(output.FloatOutput),
+        
+        # Optional output that writes all three channels in one bus transaction
+        cv.Optional(CONF_BATCHED_OUTPUT): cv.use_id(BatchedRGBOutput),
         
         # Event configurations with ESPHome-compatible defaults
         cv.Optional(CONF_ERROR, default={
@@ -166,10 +172,29 @@ CONFIG_SCHEMA = light.RGB_LIGHT_SCHEMA.extend(
         
         # OK state configuration
         cv.Optional(CONF_OK_STATE_ENABLED, default=True): cv.boolean,
+        
+        # Temporal dithering: PWM resolution of the outputs (e.g. 8 or 10 bits)
+        cv.Optional(CONF_DITHER_BITS): cv.int_range(min=1, max=16),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
 
+def validate_outputs(config):
+    """Require either a batched output or all three channel outputs, not both."""
+    channels = [key for key in (CONF_RED, CONF_GREEN, CONF_BLUE) if key in config]
+    if CONF_BATCHED_OUTPUT in config:
+        if channels:
+            raise cv.Invalid(f"'{CONF_BATCHED_OUTPUT}' cannot be combined with '{channels[0]}'")
+        return config
+    for key in (CONF_RED, CONF_GREEN, CONF_BLUE):
+        if key not in config:
+            raise cv.Invalid(f"'{key}' is required unless '{CONF_BATCHED_OUTPUT}' is set")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(CONFIG_SCHEMA, validate_outputs)
+
+
 @coroutine_with_priority(CoroPriority.STATUS)
 async def to_code(config):
     """
@@ -179,10 +204,11 @@ async def to_code(config):
     and code generation. It sets up the component with all the
     specified event configurations and connects it to the RGB outputs.
     """
-    # Get the RGB output components
-    red = await cg.get_variable(config[CONF_RED])
-    green = await cg.get_variable(config[CONF_GREEN])
-    blue = await cg.get_variable(config[CONF_BLUE])
+    # Get the output components before registering, so they set up first
+    red = await cg.get_variable(config[CONF_RED]) if CONF_RED in config else None
+    green = await cg.get_variable(config[CONF_GREEN]) if CONF_GREEN in config else None
+    blue = await cg.get_variable(config[CONF_BLUE]) if CONF_BLUE in config else None
+    batched = await cg.get_variable(config[CONF_BATCHED_OUTPUT]) if CONF_BATCHED_OUTPUT in config else None
     
     # Create the component instance
     var = cg.new_Pvariable(config[CONF_ID])
@@ -190,9 +216,12 @@ async def to_code(config):
     await light.register_light(var, config)
     
     # Connect RGB outputs
-    cg.add(var.set_red_output(red))
-    cg.add(var.set_green_output(green))
-    cg.add(var.set_blue_output(blue))
+    if batched is not None:
+        cg.add(var.set_batched_output(batched))
+    else:
+        cg.add(var.set_red_output(red))
+        cg.add(var.set_green_output(green))
+        cg.add(var.set_blue_output(blue))
     
     # Helper function to create EventConfig
     def create_event_config(event_config):
@@ -229,6 +258,8 @@ async def to_code(config):
     cg.add(var.set_brightness(config[CONF_BRIGHTNESS]))
     cg.add(var.set_priority_mode(config[CONF_PRIORITY_MODE]))
     cg.add(var.set_ok_state_enabled(config[CONF_OK_STATE_ENABLED]))
+    if CONF_DITHER_BITS in config:
+        cg.add(var.set_dither_bits(config[CONF_DITHER_BITS]))
     
     # Enable the component in the build
     cg.add_define("USE_RGB_STATUS_LED")
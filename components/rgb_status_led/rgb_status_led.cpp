@@ -1,4 +1,5 @@
 #include "rgb_status_led.h"
+#include "sigma_delta.h"
 #include "esphome/core/log.h"
 #include <cmath>
 
@@ -16,12 +17,39 @@ RGBStatusLED::RGBStatusLED() {
 void RGBStatusLED::setup() {
   ESP_LOGCONFIG(TAG, "Setting up RGB Status LED...");
   
-  // Initialize outputs to off
-  this->set_rgb_output_(0.0f, 0.0f, 0.0f);
-  
   // Mark boot start time
   this->boot_complete_time_ = millis();
   
+  // The dither grid assumes level N/max_code lands on PWM code N. FloatOutput
+  // remaps levels for min_power/max_power, which breaks that, so dithering is
+  // refused for such outputs (inversion stays on the grid and is fine).
+  if (this->dither_bits_ != 0) {
+    output::FloatOutput *outputs[3] = {this->red_output_, this->green_output_, this->blue_output_};
+    for (auto *out : outputs) {
+      if (out != nullptr && (out->get_min_power() != 0.0f || out->get_max_power() != 1.0f)) {
+        ESP_LOGW(TAG, "Dithering disabled: outputs with min_power or max_power are not supported");
+        this->dither_bits_ = 0;
+        break;
+      }
+    }
+  }
+  
+  // Dither patterns must repeat faster than the flicker limit, which the
+  // default ~16ms loop cannot do; run loop() as fast as possible instead
+  if (this->dither_bits_ != 0) {
+    this->high_freq_.start();
+  }
+  
+  // Light the boot color right away instead of waiting for loop(). Our setup
+  // priority sits just below HARDWARE, so the outputs are already set up here.
+  // In user priority mode the status is never shown, so start with the LED off.
+  if (this->priority_mode_ == PriorityMode::USER_PRIORITY) {
+    this->set_rgb_output_(0.0f, 0.0f, 0.0f);
+  } else {
+    this->last_state_ = StatusState::BOOT;
+    this->apply_state_(StatusState::BOOT);
+  }
+  
   ESP_LOGCONFIG(TAG, "RGB Status LED setup completed");
   ESP_LOGCONFIG(TAG, "  Error blink speed: %ums (matches ESPHome)", this->error_blink_speed_);
   ESP_LOGCONFIG(TAG, "  Warning blink speed: %ums (matches ESPHome)", this->warning_blink_speed_);
@@ -42,6 +70,38 @@ void RGBStatusLED::dump_config() {
                 this->ok_color_.r * 100.0f, this->ok_color_.g * 100.0f, this->ok_color_.b * 100.0f);
   ESP_LOGCONFIG(TAG, "  Boot Color: R=%.1f, G=%.1f, B=%.1f", 
                 this->boot_color_.r * 100.0f, this->boot_color_.g * 100.0f, this->boot_color_.b * 100.0f);
+  
+  // Boot timing: power-on to first light, and first light until no OTA, error or
+  // warning is active (the fixed 10s BOOT display window is not counted)
+  if (this->first_light_time_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Time to first light: %ums", this->first_light_time_);
+  } else {
+    ESP_LOGCONFIG(TAG, "  Time to first light: not lit yet");
+  }
+  if (this->ok_reached_time_ != 0) {
+    ESP_LOGCONFIG(TAG, "  First light to healthy: %ums", this->ok_reached_time_ - this->first_light_time_);
+  } else {
+    ESP_LOGCONFIG(TAG, "  First light to healthy: not reached yet");
+  }
+  
+  if (this->dither_bits_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Dithering: %u-bit, update interval ~%uus, flicker limit %uHz", this->dither_bits_,
+                  this->dither_interval_us_, DITHER_MIN_FLICKER_HZ);
+  }
+  ESP_LOGCONFIG(TAG, "  Output: %s, %u transactions",
+                (this->batched_output_ != nullptr) ? "batched" : "per-channel", this->output_transactions_);
+  
+  // Flag change to set_level latency; polled samples include the polling delay
+  if (this->latency_probe_.count > 0) {
+    ESP_LOGCONFIG(TAG, "  Status reaction latency (polled, upper bound): min=%uus, max=%uus, p99<=%uus (%u samples)",
+                  this->latency_probe_.min_us, this->latency_probe_.max_us, this->latency_probe_.p99_us(),
+                  this->latency_probe_.count);
+  }
+  if (this->notify_latency_probe_.count > 0) {
+    ESP_LOGCONFIG(TAG, "  Status reaction latency (notified): min=%uus, max=%uus, p99<=%uus (%u samples)",
+                  this->notify_latency_probe_.min_us, this->notify_latency_probe_.max_us,
+                  this->notify_latency_probe_.p99_us(), this->notify_latency_probe_.count);
+  }
 }
 
 light::LightTraits RGBStatusLED::get_traits() {
@@ -69,14 +129,47 @@ void RGBStatusLED::loop() {
   if (this->first_loop_) {
     this->first_loop_ = false;
     this->last_state_change_ = millis();
+    
+    // Don't trust the write cache across setup: resend every level on the
+    // first render in case a setup() write never reached the hardware
+    this->levels_valid_ = false;
+    
+    // Baseline for flag change detection; flags set during setup are not timed
+    this->last_status_flags_ = App.get_app_state() & (STATUS_LED_ERROR | STATUS_LED_WARNING);
+    this->last_check_us_ = micros();
     return;
   }
   
+  this->check_status_flags_(false);
   this->update_state_();
 }
 
+void RGBStatusLED::notify_status_changed() {
+  if (this->first_loop_) {
+    return;  // loop() has not started yet, it will pick the change up
+  }
+  this->check_status_flags_(true);
+  this->update_state_();
+}
+
+void RGBStatusLED::check_status_flags_(bool notified) {
+  uint32_t now = micros();
+  uint32_t flags = App.get_app_state() & (STATUS_LED_ERROR | STATUS_LED_WARNING);
+  if (flags != this->last_status_flags_) {
+    // A notify caller has just set the flag, so the change happened now. A
+    // polled change happened some time after the previous check; timing from
+    // there gives an upper bound that includes the polling delay.
+    this->last_status_flags_ = flags;
+    this->flag_change_us_ = notified ? now : this->last_check_us_;
+    this->latency_notified_ = notified;
+    this->latency_pending_ = true;
+  }
+  this->last_check_us_ = now;
+}
+
 float RGBStatusLED::get_setup_priority() const { 
-  return setup_priority::HARDWARE; 
+  // Just below the outputs (HARDWARE) so they are ready for the boot color in setup()
+  return setup_priority::HARDWARE - 1.0f; 
 }
 
 float RGBStatusLED::get_loop_priority() const { 
@@ -93,8 +186,18 @@ void RGBStatusLED::update_state_() {
     this->is_blink_on_ = false;  // Reset blink state
   }
   
+  // Record the first time the device is healthy, independent of the BOOT window
+  if (this->ok_reached_time_ == 0 && this->first_light_time_ != 0 && this->is_healthy_()) {
+    this->ok_reached_time_ = millis();
+    ESP_LOGD(TAG, "Device healthy %ums after first light (LED keeps BOOT for the 10s window)",
+             this->ok_reached_time_ - this->first_light_time_);
+  }
+  
   // Apply the current state
   this->apply_state_(new_state);
+  
+  // A flag change that did not lead to an output write is not a sample
+  this->latency_pending_ = false;
 }
 
 StatusState RGBStatusLED::determine_status_state_() {
@@ -158,6 +261,15 @@ StatusState RGBStatusLED::determine_status_state_() {
   }
 }
 
+bool RGBStatusLED::is_healthy_() {
+  // Healthy means nothing above BOOT in determine_status_state_() applies,
+  // i.e. the device would show OK/WiFi/API once the BOOT window ends
+  if (this->ota_active_) {
+    return false;
+  }
+  return (App.get_app_state() & (STATUS_LED_ERROR | STATUS_LED_WARNING)) == 0u;
+}
+
 bool RGBStatusLED::should_show_status_() {
   if (this->priority_mode_ == PriorityMode::USER_PRIORITY) {
     return false;  // User always has priority
@@ -222,8 +334,11 @@ void RGBStatusLED::apply_blink_effect_(const EventConfig &config, uint32_t perio
   // Apply brightness override if specified
   float brightness_scale = (config.brightness == 1.0f) ? this->brightness_ : config.brightness;
   
-  if ((now % period) < on_time) {
-    if (!this->is_blink_on_) {
+  // Blink phase starts at the state change so a new state lights up immediately
+  if (((now - this->last_state_change_) % period) < on_time) {
+    // With dithering, refresh every loop during the on-phase so the residual
+    // can average out within the phase instead of one sample per blink
+    if (!this->is_blink_on_ || this->dither_bits_ != 0) {
       this->set_rgb_output_(config.color, brightness_scale);
       this->is_blink_on_ = true;
     }
@@ -323,15 +438,66 @@ void RGBStatusLED::set_rgb_output_(const RGBColor &color, float brightness_scale
 
 void RGBStatusLED::set_rgb_output_(float r, float g, float b, float brightness_scale) {
   float final_brightness = this->brightness_ * brightness_scale;
+  float levels[3] = {r * final_brightness, g * final_brightness, b * final_brightness};
+  bool wrote = false;
+  if (this->dither_bits_ != 0) {
+    this->dither_levels_(levels);
+  }
+  
+  if (this->batched_output_ != nullptr) {
+    // Commit all three channels in one transaction, skipping unchanged colors
+    if (!this->levels_valid_ || levels[0] != this->last_levels_[0] || levels[1] != this->last_levels_[1] ||
+        levels[2] != this->last_levels_[2]) {
+      this->batched_output_->write_rgb(levels[0], levels[1], levels[2]);
+      this->output_transactions_++;
+      wrote = true;
+    }
+  } else {
+    // Per-channel fallback, only touching channels whose level changed
+    output::FloatOutput *outputs[3] = {this->red_output_, this->green_output_, this->blue_output_};
+    for (uint8_t i = 0; i < 3; i++) {
+      if (outputs[i] != nullptr && (!this->levels_valid_ || levels[i] != this->last_levels_[i])) {
+        outputs[i]->set_level(levels[i]);
+        this->output_transactions_++;
+        wrote = true;
+      }
+    }
+  }
+  this->last_levels_[0] = levels[0];
+  this->last_levels_[1] = levels[1];
+  this->last_levels_[2] = levels[2];
+  this->levels_valid_ = true;
+  
+  // Flag change to first set_level latency; a cached (skipped) write is not a
+  // sample, update_state_() discards it if nothing is written this render
+  if (this->latency_pending_ && wrote) {
+    auto &probe = this->latency_notified_ ? this->notify_latency_probe_ : this->latency_probe_;
+    probe.record(micros() - this->flag_change_us_);
+    this->latency_pending_ = false;
+  }
   
-  if (this->red_output_ != nullptr) {
-    this->red_output_->set_level(r * final_brightness);
+  // Time-to-first-light measurement (millis() counts from power-on)
+  if (this->first_light_time_ == 0 && final_brightness > 0.0f && (r > 0.0f || g > 0.0f || b > 0.0f)) {
+    this->first_light_time_ = millis();
   }
-  if (this->green_output_ != nullptr) {
-    this->green_output_->set_level(g * final_brightness);
+}
+
+void RGBStatusLED::dither_levels_(float *levels) {
+  // Track the real update interval (1/8 smoothing); gaps such as a blink
+  // off-phase are not updates and are ignored
+  uint32_t now = micros();
+  uint32_t delta = now - this->last_dither_us_;
+  this->last_dither_us_ = now;
+  if (delta < 100000) {
+    this->dither_interval_us_ = (this->dither_interval_us_ * 7 + delta) / 8;
   }
-  if (this->blue_output_ != nullptr) {
-    this->blue_output_->set_level(b * final_brightness);
+  
+  // Fractions whose pattern would repeat slower than DITHER_MIN_FLICKER_HZ are
+  // rounded instead of dithered
+  const int32_t max_code = (1 << this->dither_bits_) - 1;
+  const int32_t max_spacing = sigma_delta_max_spacing(this->dither_interval_us_);
+  for (uint8_t i = 0; i < 3; i++) {
+    levels[i] = sigma_delta_quantize(levels[i], max_code, this->dither_residual_[i], max_spacing);
   }
 }
 
@@ -5,6 +5,9 @@
 #include "esphome/components/output/float_output.h"
 #include "esphome/components/light/light_output.h"
 #include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/rgb_status_led_common/batched_rgb_output.h"
+#include "esphome/components/rgb_status_led_common/latency_probe.h"
 #include <string>
 
 namespace esphome {
@@ -99,6 +102,7 @@ class RGBStatusLED : public light::LightOutput, public Component {
   void set_red_output(output::FloatOutput *output) { red_output_ = output; }
   void set_green_output(output::FloatOutput *output) { green_output_ = output; }
   void set_blue_output(output::FloatOutput *output) { blue_output_ = output; }
+  void set_batched_output(rgb_status_led_common::BatchedRGBOutput *output) { batched_output_ = output; }
 
   // Global configuration
   void set_error_blink_speed(uint32_t speed) { error_blink_speed_ = speed; }
@@ -108,6 +112,16 @@ class RGBStatusLED : public light::LightOutput, public Component {
     priority_mode_ = (mode == "user") ? PriorityMode::USER_PRIORITY : PriorityMode::STATUS_PRIORITY;
   }
   void set_ok_state_enabled(bool enabled) { ok_state_enabled_ = enabled; }
+  void set_dither_bits(uint8_t bits) { dither_bits_ = bits; }
+
+  /**
+   * @brief Re-render immediately after a status flag change
+   * 
+   * Status flags are also picked up on every loop(); calling this right after
+   * status_set_error()/status_set_warning() (e.g. from a lambda) skips the
+   * wait for the next loop iteration.
+   */
+  void notify_status_changed();
 
  protected:
   /// @brief Tag for logging
@@ -117,6 +131,19 @@ class RGBStatusLED : public light::LightOutput, public Component {
   output::FloatOutput *red_output_{nullptr};
   output::FloatOutput *green_output_{nullptr};
   output::FloatOutput *blue_output_{nullptr};
+  rgb_status_led_common::BatchedRGBOutput *batched_output_{nullptr};  ///< Used instead of the channels above when set
+  
+  // Output write cache - levels are only sent when they change
+  float last_levels_[3]{0.0f, 0.0f, 0.0f};  ///< Last levels written (R, G, B)
+  bool levels_valid_{false};                  ///< Whether last_levels_ reflects the hardware
+  uint32_t output_transactions_{0};           ///< Number of output writes, for benchmarking
+  
+  // Temporal dithering (sigma-delta) for coarse PWM outputs
+  uint8_t dither_bits_{0};                    ///< Output resolution to dither for (0 = disabled)
+  int32_t dither_residual_[3]{0, 0, 0};       ///< Per-channel carried error, 1/256 of an output step
+  uint32_t dither_interval_us_{16000};        ///< Smoothed time between dither updates
+  uint32_t last_dither_us_{0};                ///< micros() of the previous dither update
+  HighFrequencyLoopRequester high_freq_;      ///< Keeps loop() fast enough to dither without flicker
 
   /**
    * @brief RGB color structure
@@ -158,6 +185,8 @@ class RGBStatusLED : public light::LightOutput, public Component {
   bool first_loop_{true};                           ///< First loop iteration flag
   uint32_t last_state_change_{0};                   ///< Timestamp of last state change
   uint32_t boot_complete_time_{0};                   ///< Timestamp when boot phase completes
+  uint32_t first_light_time_{0};                     ///< millis() when the LED first lit up (0 = not yet)
+  uint32_t ok_reached_time_{0};                      ///< millis() when the device was first healthy (0 = not yet)
   
   // Connection state tracking (set via automation callbacks)
   bool wifi_connected_{false};        ///< WiFi connection status
@@ -169,9 +198,11 @@ class RGBStatusLED : public light::LightOutput, public Component {
   void update_state_();                                           ///< Main state update logic
   void set_rgb_output_(const RGBColor &color, float brightness_scale = 1.0f);  ///< Set RGB output with color
   void set_rgb_output_(float r, float g, float b, float brightness_scale = 1.0f); ///< Set RGB output with components
+  void dither_levels_(float *levels);                              ///< Quantize R, G, B levels with error carry
   StatusState determine_status_state_();                           ///< Determine current status based on all inputs
   void apply_state_(StatusState state);                           ///< Apply visual effects for a state
   bool should_show_status_();                                     ///< Check if status should override user control
+  bool is_healthy_();                                             ///< No OTA, error or warning active
   void apply_effect_(const EventConfig &config);                   ///< Apply effect based on configuration
   
   // Effect methods
@@ -179,6 +210,16 @@ class RGBStatusLED : public light::LightOutput, public Component {
   void apply_blink_effect_(const EventConfig &config, uint32_t period, uint32_t on_time); ///< Blink effect
   void apply_pulse_effect_(const EventConfig &config);            ///< Pulse effect
   
+  // Status flag change tracking and latency measurement
+  uint32_t last_status_flags_{0};      ///< Error/warning bits seen on the last check
+  uint32_t last_check_us_{0};          ///< micros() of the previous flag check
+  uint32_t flag_change_us_{0};         ///< Earliest possible time of the last flag change
+  bool latency_pending_{false};        ///< Waiting for the first set_level after a flag change
+  bool latency_notified_{false};       ///< Pending change came through notify_status_changed()
+  rgb_status_led_common::LatencyProbe latency_probe_;         ///< Polled changes, upper bound incl. polling delay
+  rgb_status_led_common::LatencyProbe notify_latency_probe_;  ///< Changes pushed via notify_status_changed()
+  void check_status_flags_(bool notified);  ///< Detect error/warning bit changes
+  
   // Blink effect management
   bool is_blink_on_{false};            ///< Current blink state (on/off)
   uint32_t last_blink_toggle_{0};      ///< Timestamp of last blink toggle
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace esphome {
+namespace rgb_status_led {
+
+/// Slowest allowed repeat rate of a dither pattern before it reads as flicker
+static const uint32_t DITHER_MIN_FLICKER_HZ = 50;
+
+/**
+ * @brief First-order sigma-delta quantizer for one output channel
+ * 
+ * Quantizes a level (0.0-1.0) to the step size of an output with max_code + 1
+ * codes, and carries the remainder (8 fractional bits) into the next call via
+ * residual. Over a few calls the average output matches the requested level.
+ * 
+ * A fraction f of a code emits the minority code about every 1/min(f, 1-f)
+ * calls. When that spacing exceeds max_spacing calls, the pattern would repeat
+ * slower than the flicker limit, so the level is rounded to the nearest code
+ * instead. Pure integer state, no ESPHome dependencies, so it also builds on
+ * the host (see benchmarks/dither_bench.cpp).
+ */
+inline float sigma_delta_quantize(float level, int32_t max_code, int32_t &residual, int32_t max_spacing) {
+  level = std::max(0.0f, std::min(1.0f, level));
+  int32_t target = static_cast<int32_t>(level * static_cast<float>(max_code << 8) + 0.5f);
+  int32_t frac = target & 0xFF;
+  int32_t minority = std::min(frac, 256 - frac);
+  int32_t code;
+  if (minority != 0 && max_spacing < 256 && minority * max_spacing < 256) {
+    code = std::min((target + 128) >> 8, max_code);
+    residual = 0;
+  } else {
+    int32_t acc = target + residual;
+    code = std::min(acc >> 8, max_code);
+    residual = acc - (code << 8);
+  }
+  return static_cast<float>(code) / static_cast<float>(max_code);
+}
+
+/// Longest minority-code spacing (in calls) that stays above DITHER_MIN_FLICKER_HZ
+inline int32_t sigma_delta_max_spacing(uint32_t update_interval_us) {
+  if (update_interval_us == 0) {
+    return 1;
+  }
+  return std::max<int32_t>(1, 1000000 / (DITHER_MIN_FLICKER_HZ * update_interval_us));
+}
+
+}  // namespace rgb_status_led
+}  // namespace esphome
@@ -0,0 +1,21 @@
+"""
+ESPHome RGB Status LED shared helpers
+
+Header-only code shared by rgb_status_led and rgb_status_led_simple.
+Not configured directly; both components auto-load it.
+
+Author: Bluscream
+License: MIT
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+
+# Component metadata
+CODEOWNERS = ["@esphome/core"]
+
+# Namespace for the shared helpers
+rgb_status_led_common_ns = cg.esphome_ns.namespace("rgb_status_led_common")
+BatchedRGBOutput = rgb_status_led_common_ns.class_("BatchedRGBOutput")
+
+CONFIG_SCHEMA = cv.Schema({})
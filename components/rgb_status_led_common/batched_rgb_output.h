@@ -0,0 +1,21 @@
+#pragma once
+
+namespace esphome {
+namespace rgb_status_led_common {
+
+/**
+ * @brief Optional output that commits all three channels in one transaction
+ * 
+ * Implement this for a driver whose R, G and B channels share one bus or chip
+ * (PCA9685, MCP or other I2C/SPI expanders). The component then writes a color
+ * with a single call instead of three set_level calls, which avoids extra bus
+ * transactions and torn intermediate colors.
+ */
+class BatchedRGBOutput {
+ public:
+  virtual ~BatchedRGBOutput() = default;
+  virtual void write_rgb(float r, float g, float b) = 0;
+};
+
+}  // namespace rgb_status_led_common
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace rgb_status_led_common {
+
+/**
+ * @brief Latency probe for status flag changes
+ * 
+ * Records the delay from a status flag change to the first set_level call
+ * that follows it. Samples are sorted into power-of-two buckets so p99 can
+ * be estimated without storing individual samples; the reported p99 is the
+ * upper bound of the bucket that contains it.
+ */
+struct LatencyProbe {
+  static const uint8_t NUM_BUCKETS = 24;  ///< Bucket i holds [2^i, 2^(i+1)) us, ~16s max
+  
+  uint32_t count{0};                 ///< Number of recorded samples
+  uint32_t min_us{UINT32_MAX};       ///< Smallest recorded latency
+  uint32_t max_us{0};                ///< Largest recorded latency
+  uint32_t buckets[NUM_BUCKETS]{};   ///< Sample histogram
+  
+  void record(uint32_t us) {
+    uint8_t bucket = (us == 0) ? 0 : 31 - __builtin_clz(us);
+    if (bucket >= NUM_BUCKETS)
+      bucket = NUM_BUCKETS - 1;
+    this->buckets[bucket]++;
+    this->count++;
+    if (us < this->min_us)
+      this->min_us = us;
+    if (us > this->max_us)
+      this->max_us = us;
+  }
+  
+  uint32_t p99_us() const {
+    uint32_t target = this->count - this->count / 100;  // ceil(0.99 * count)
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < NUM_BUCKETS; i++) {
+      seen += this->buckets[i];
+      if (seen >= target) {
+        uint32_t upper = (2u << i) - 1;
+        return upper < this->max_us ? upper : this->max_us;
+      }
+    }
+    return this->max_us;
+  }
+};
+
+}  // namespace rgb_status_led_common
+}  // namespace esphome
@@ -0,0 +1,58 @@
+"""
+ESPHome RGB Status LED Mock Bus
+
+A fake RGB bus for benchmarking the rgb_status_led output path. It counts
+transactions and can simulate a per-transaction bus time. Use its ID as the
+rgb_status_led batched_output, or use its red/green/blue channels as regular
+outputs to compare against the per-channel path.
+
+Author: Bluscream
+License: MIT
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import output
+from esphome.components.rgb_status_led_common import BatchedRGBOutput
+from esphome.const import CONF_ID, CONF_RED, CONF_GREEN, CONF_BLUE
+
+# Component metadata
+CODEOWNERS = ["@esphome/core"]
+AUTO_LOAD = ["output", "rgb_status_led_common"]
+
+# Configuration keys
+CONF_TRANSACTION_TIME = "transaction_time"
+
+# Namespace for the component
+rgb_status_led_mock_bus_ns = cg.esphome_ns.namespace("rgb_status_led_mock_bus")
+MockBus = rgb_status_led_mock_bus_ns.class_("MockBus", BatchedRGBOutput, cg.Component)
+MockBusChannel = rgb_status_led_mock_bus_ns.class_("MockBusChannel", output.FloatOutput)
+
+# Schema for one mock channel output
+ChannelSchema = output.FLOAT_OUTPUT_SCHEMA.extend({
+    cv.Required(CONF_ID): cv.declare_id(MockBusChannel),
+})
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(MockBus),
+        cv.Optional(CONF_TRANSACTION_TIME, default="0us"): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_RED): ChannelSchema,
+        cv.Optional(CONF_GREEN): ChannelSchema,
+        cv.Optional(CONF_BLUE): ChannelSchema,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_transaction_time(config[CONF_TRANSACTION_TIME]))
+    
+    # Optional per-channel outputs on the same bus
+    for index, key in enumerate((CONF_RED, CONF_GREEN, CONF_BLUE)):
+        if key in config:
+            channel = cg.new_Pvariable(config[key][CONF_ID])
+            await output.register_output(channel, config[key])
+            cg.add(channel.set_bus(var))
+            cg.add(channel.set_channel(index))
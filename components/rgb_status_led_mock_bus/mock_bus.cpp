@@ -0,0 +1,38 @@
+#include "mock_bus.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace rgb_status_led_mock_bus {
+
+const char *const MockBus::TAG = "rgb_status_led_mock_bus";
+
+void MockBus::dump_config() {
+  ESP_LOGCONFIG(TAG, "RGB Status LED Mock Bus:");
+  ESP_LOGCONFIG(TAG, "  Transaction time: %uus", this->transaction_time_);
+  ESP_LOGCONFIG(TAG, "  Transactions: %u", this->transactions_);
+  ESP_LOGCONFIG(TAG, "  Levels: R=%.3f, G=%.3f, B=%.3f", this->levels_[0], this->levels_[1], this->levels_[2]);
+}
+
+void MockBus::write_rgb(float r, float g, float b) {
+  this->levels_[0] = r;
+  this->levels_[1] = g;
+  this->levels_[2] = b;
+  this->transaction_();
+}
+
+void MockBus::write_channel(uint8_t channel, float level) {
+  if (channel < 3) {
+    this->levels_[channel] = level;
+  }
+  this->transaction_();
+}
+
+void MockBus::transaction_() {
+  this->transactions_++;
+  if (this->transaction_time_ > 0) {
+    delayMicroseconds(this->transaction_time_);
+  }
+}
+
+}  // namespace rgb_status_led_mock_bus
+}  // namespace esphome
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/output/float_output.h"
+#include "esphome/components/rgb_status_led_common/batched_rgb_output.h"
+
+namespace esphome {
+namespace rgb_status_led_mock_bus {
+
+/**
+ * @brief Mock RGB bus that counts transactions
+ * 
+ * Stands in for a PCA9685 or I2C/SPI expander when benchmarking the RGB
+ * Status LED output path. A batched write_rgb() is one transaction; each
+ * MockBusChannel set_level is one transaction. An optional transaction time
+ * busy-waits to simulate the bus cost.
+ */
+class MockBus : public rgb_status_led_common::BatchedRGBOutput, public Component {
+ public:
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  // Batched output interface - all three channels in one transaction
+  void write_rgb(float r, float g, float b) override;
+
+  // Single channel write (0 = red, 1 = green, 2 = blue), used by MockBusChannel
+  void write_channel(uint8_t channel, float level);
+
+  void set_transaction_time(uint32_t transaction_time) { transaction_time_ = transaction_time; }
+  uint32_t get_transaction_count() const { return this->transactions_; }
+
+ protected:
+  /// @brief Tag for logging
+  static const char *const TAG;
+
+  void transaction_();  ///< Count and simulate one bus transaction
+
+  uint32_t transaction_time_{0};          ///< Simulated time per transaction in microseconds
+  uint32_t transactions_{0};              ///< Number of transactions so far
+  float levels_[3]{0.0f, 0.0f, 0.0f};     ///< Last level written per channel
+};
+
+/**
+ * @brief One channel of a MockBus, usable as a regular FloatOutput
+ * 
+ * Lets the per-channel path be benchmarked on the same mock bus as the
+ * batched path.
+ */
+class MockBusChannel : public output::FloatOutput {
+ public:
+  void set_bus(MockBus *bus) { bus_ = bus; }
+  void set_channel(uint8_t channel) { channel_ = channel; }
+
+ protected:
+  void write_state(float state) override { this->bus_->write_channel(this->channel_, state); }
+
+  MockBus *bus_{nullptr};
+  uint8_t channel_{0};
+};
+
+}  // namespace rgb_status_led_mock_bus
+}  // namespace esphome
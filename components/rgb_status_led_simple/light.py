@@ -16,7 +16,7 @@ from esphome.const import CONF_ID, CONF_RED, CONF_GREEN, CONF_BLUE, CONF_BRIGHTN
 
 # Component metadata
 CODEOWNERS = ["@esphome/core"]
-AUTO_LOAD = ["light"]
+AUTO_LOAD = ["light", "rgb_status_led_common"]
 
 # Configuration keys
 CONF_ERROR_COLOR = "error_color"
@@ -26,7 +26,7 @@ CONF_WARNING_BLINK_SPEED = "warning_blink_speed"
 
 # Namespace for the component
 rgb_status_led_simple_ns = cg.esphome_ns.namespace("rgb_status_led_simple")
-RGBStatusLEDSimple = rgb_status_led_simple_ns.class_("RGBStatusLEDSimple", light.LightOutput)
+RGBStatusLEDSimple = rgb_status_led_simple_ns.class_("RGBStatusLEDSimple", light.LightOutput, cg.Component)
 
 # Schema for RGB color configuration
 ColorSchema = cv.Schema({
@@ -53,6 +53,7 @@ CONFIG_SCHEMA = light.RGB_LIGHT_SCHEMA.extend(
 async def to_code(config):
     # Create the light output
     var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
     
     # Set the output pins
     red = await cg.get_variable(config[CONF_RED])
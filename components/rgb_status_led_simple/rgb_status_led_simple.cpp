@@ -26,18 +26,49 @@ void RGBStatusLEDSimple::dump_config() {
   ESP_LOGCONFIG(TAG, "  Warning Blink Speed: %ums", warning_blink_speed_);
   ESP_LOGCONFIG(TAG, "  Brightness: %.0f%%", brightness_ * 100);
   ESP_LOGCONFIG(TAG, "  Supports manual control when no status is active");
+  if (latency_probe_.count > 0) {
+    ESP_LOGCONFIG(TAG, "  Status reaction latency (polled, upper bound): min=%uus, max=%uus, p99<=%uus (%u samples)",
+                  latency_probe_.min_us, latency_probe_.max_us, latency_probe_.p99_us(), latency_probe_.count);
+  }
+  if (notify_latency_probe_.count > 0) {
+    ESP_LOGCONFIG(TAG, "  Status reaction latency (notified): min=%uus, max=%uus, p99<=%uus (%u samples)",
+                  notify_latency_probe_.min_us, notify_latency_probe_.max_us, notify_latency_probe_.p99_us(),
+                  notify_latency_probe_.count);
+  }
 }
 
-void RGBStatusLEDSimple::loop() {
+void RGBStatusLEDSimple::loop() { render_(false); }
+
+void RGBStatusLEDSimple::render_(bool notified) {
   uint32_t app_state = App.get_app_state();
   bool has_status = (app_state & (STATUS_LED_ERROR | STATUS_LED_WARNING)) != 0;
   uint32_t now = millis();
 
+  // Restart the blink phase on every flag change so the new status shows immediately.
+  // A notify caller has just set the flag, so the change happened now; a polled
+  // change happened some time after the previous check, so latency is timed from
+  // there as an upper bound that includes the polling delay.
+  uint32_t now_us = micros();
+  uint32_t flags = app_state & (STATUS_LED_ERROR | STATUS_LED_WARNING);
+  if (first_check_) {
+    first_check_ = false;
+    last_status_flags_ = flags;
+    status_since_ = now;
+  } else if (flags != last_status_flags_) {
+    last_status_flags_ = flags;
+    status_since_ = now;
+    flag_change_us_ = notified ? now_us : last_check_us_;
+    latency_notified_ = notified;
+    latency_pending_ = true;
+  }
+  last_check_us_ = now_us;
+  uint32_t phase = now - status_since_;
+
   if (has_status) {
     // Status takes priority
     if (app_state & STATUS_LED_ERROR) {
       // Fast blink with error color
-      bool led_on = (now % error_blink_speed_) < (error_blink_speed_ * 3 / 5);  // 60% duty cycle
+      bool led_on = (phase % error_blink_speed_) < (error_blink_speed_ * 3 / 5);  // 60% duty cycle
       set_rgb_output_(
         error_color_.r,
         error_color_.g,
@@ -47,7 +78,7 @@ void RGBStatusLEDSimple::loop() {
     } 
     else if (app_state & STATUS_LED_WARNING) {
       // Slow blink with warning color
-      bool led_on = (now % warning_blink_speed_) < (warning_blink_speed_ / 6);  // ~17% duty cycle
+      bool led_on = (phase % warning_blink_speed_) < (warning_blink_speed_ / 6);  // ~17% duty cycle
       set_rgb_output_(
         warning_color_.r,
         warning_color_.g,
@@ -73,8 +104,15 @@ void RGBStatusLEDSimple::loop() {
       set_rgb_output_(0.0f, 0.0f, 0.0f, 0.0f);
     }
   }
+
+  // A flag change that did not lead to an output write is not a sample
+  latency_pending_ = false;
 }
 
+float RGBStatusLEDSimple::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+float RGBStatusLEDSimple::get_loop_priority() const { return 50.0f; }
+
 light::LightTraits RGBStatusLEDSimple::get_traits() {
   auto traits = light::LightTraits();
   traits.set_supported_color_modes({light::ColorMode::RGB});
@@ -119,6 +157,13 @@ void RGBStatusLEDSimple::set_rgb_output_(float r, float g, float b, float bright
   if (red_output_) red_output_->set_level(r * final_brightness);
   if (green_output_) green_output_->set_level(g * final_brightness);
   if (blue_output_) blue_output_->set_level(b * final_brightness);
+
+  bool wrote = red_output_ || green_output_ || blue_output_;
+  if (latency_pending_ && wrote) {
+    auto &probe = latency_notified_ ? notify_latency_probe_ : latency_probe_;
+    probe.record(micros() - flag_change_us_);
+    latency_pending_ = false;
+  }
 }
 
 }  // namespace rgb_status_led_simple
@@ -5,6 +5,7 @@
 #include "esphome/components/output/float_output.h"
 #include "esphome/components/light/light_output.h"
 #include "esphome/core/application.h"
+#include "esphome/components/rgb_status_led_common/latency_probe.h"
 
 namespace esphome {
 namespace rgb_status_led_simple {
@@ -36,6 +37,10 @@ class RGBStatusLEDSimple : public light::LightOutput, public Component {
   void set_warning_blink_speed(uint32_t speed) { warning_blink_speed_ = speed; }
   void set_brightness(float brightness) { brightness_ = brightness; }
 
+  // Re-render right away after status_set_error()/status_set_warning()
+  // instead of waiting for the next loop()
+  void notify_status_changed() { render_(true); }
+
  protected:
   /// @brief Tag for logging
   static const char *const TAG;
@@ -68,8 +73,20 @@ class RGBStatusLEDSimple : public light::LightOutput, public Component {
   RGBColor manual_color_{1.0f, 1.0f, 1.0f};   // Default to white
   float manual_brightness_{1.0f};             // Default to full brightness
 
+  // Status flag change tracking
+  uint32_t last_status_flags_{0};             // Error/warning bits seen on the last loop
+  uint32_t status_since_{0};                  // millis() of the last flag change, blink phase origin
+  uint32_t last_check_us_{0};                 // micros() of the previous loop's flag check
+  uint32_t flag_change_us_{0};                // Earliest possible time of the last flag change
+  bool first_check_{true};                    // Next loop only records the flag baseline
+  bool latency_pending_{false};               // Waiting for the first set_level after a change
+  bool latency_notified_{false};              // Pending change came through notify_status_changed()
+  rgb_status_led_common::LatencyProbe latency_probe_;         // Polled changes, upper bound
+  rgb_status_led_common::LatencyProbe notify_latency_probe_;  // Changes pushed via notify_status_changed()
+
  private:
   // Internal methods
+  void render_(bool notified);
   void set_rgb_output_(const RGBColor &color, float brightness_scale = 1.0f);
   void set_rgb_output_(float r, float g, float b, float brightness_scale = 1.0f);
 };